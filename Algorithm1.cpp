@@ -52,9 +52,10 @@ int Algorithm1::evaluateMove(char direction) {
     // Make a copy of the board to simulate move
     std::vector<std::vector<int>> testBoard = board;
 
-    // Check if move is valid
+    // Check if move is valid; mergeTiles reports a change for any non-empty
+    // line, so also make sure at least one tile actually moved or merged
     bool validMove = mergeTiles(testBoard, n, direction);
-    if (!validMove) {
+    if (!validMove || testBoard == board) {
         return -1; // Invalid move
     }
 
@@ -88,7 +89,11 @@ Algorithm1::Algorithm1(int boardSize, int reverseValue) : n(boardSize), P(revers
     placeNewTile(n, P, board);
 }
 
-char Algorithm1::makeMove() {
+Algorithm1::Algorithm1(int boardSize, int reverseValue, const std::vector<std::vector<int>>& startBoard)
+    : n(boardSize), P(reverseValue), board(startBoard), moves(0) {
+}
+
+char Algorithm1::findBestMove() {
     std::vector<char> directions = {'w', 's', 'a', 'd'};
     char bestMove = 'x'; // Default to invalid move
     int bestScore = -1;
@@ -106,7 +111,7 @@ char Algorithm1::makeMove() {
     if (bestMove == 'x') {
         for (char dir : directions) {
             std::vector<std::vector<int>> testBoard = board;
-            if (mergeTiles(testBoard, n, dir)) {
+            if (mergeTiles(testBoard, n, dir) && testBoard != board) {
                 bestMove = dir;
                 break;
             }
@@ -118,6 +123,15 @@ char Algorithm1::makeMove() {
         return 'q'; // Quit
     }
 
+    return bestMove;
+}
+
+char Algorithm1::makeMove() {
+    char bestMove = findBestMove();
+    if (bestMove == 'q') {
+        return 'q'; // No valid move, game is over
+    }
+
     // Apply the best move
     mergeTiles(board, n, bestMove);
     placeNewTile(n, P, board);
@@ -28,6 +28,12 @@ public:
     // Constructor
     Algorithm1(int boardSize, int reverseValue);
 
+    // Constructor for an existing board state (no initial tile is placed)
+    Algorithm1(int boardSize, int reverseValue, const std::vector<std::vector<int>>& startBoard);
+
+    // Pick the best move for the current board without applying it ('q' if none)
+    char findBestMove();
+
     // Make the best move based on evaluation
     char makeMove();
 
@@ -0,0 +1,394 @@
+#include "Server.h"
+#include "Algorithm1.h"
+#include <iostream>
+#include <sstream>
+#include <thread>
+#include <chrono>
+#include <cstring>    // For strncpy and strerror
+#include <cstdlib>    // For strtol
+#include <climits>    // For INT_MIN and INT_MAX
+#include <cerrno>     // For errno
+#include <csignal>    // For sigaction and pthread_sigmask
+#include <unistd.h>   // For read, close and unlink
+#include <fcntl.h>    // For fcntl
+#include <poll.h>     // For ppoll
+#include <sys/socket.h>
+#include <sys/stat.h> // For lstat
+#include <sys/un.h>
+
+// Longest request line accepted; a valid 5x5 request is well under 200 bytes
+const size_t MAX_REQUEST_LENGTH = 4096;
+
+// Set by SIGINT or SIGTERM to ask runSocket to shut down
+static volatile sig_atomic_t stopRequested = 0;
+
+static void requestStop(int) {
+    stopRequested = 1;
+}
+
+// Implementation of private methods
+bool GameServer::readField(std::istringstream& in, const std::string& name, int& value, std::string& error) {
+    std::string token;
+    if (!(in >> token)) {
+        error = "missing " + name;
+        return false;
+    }
+
+    errno = 0;
+    char* end = nullptr;
+    long parsed = std::strtol(token.c_str(), &end, 10);
+    if (end == token.c_str() || *end != '\0') {
+        error = name + " is not a number: " + token;
+        return false;
+    }
+    if (errno == ERANGE || parsed < INT_MIN || parsed > INT_MAX) {
+        error = name + " is out of range: " + token;
+        return false;
+    }
+
+    value = static_cast<int>(parsed);
+    return true;
+}
+
+bool GameServer::parseRequest(const std::string& line, int& n, int& P, int& solver, int& budget,
+                              std::vector<std::vector<int>>& board, std::string& error) {
+    std::istringstream in(line);
+
+    if (!readField(in, "board size", n, error)) return false;
+    if (n < 3 || n > 5) {
+        error = "board size must be 3, 4 or 5";
+        return false;
+    }
+
+    if (!readField(in, "reverse mode", P, error)) return false;
+    if (P != 512 && P != 256 && P != 128) {
+        error = "reverse mode must be 512, 256 or 128";
+        return false;
+    }
+
+    if (!readField(in, "solver", solver, error)) return false;
+    if (solver != 1) {
+        error = "unknown solver " + std::to_string(solver);
+        return false;
+    }
+
+    if (!readField(in, "budget", budget, error)) return false;
+    if (budget < 0) {
+        error = "budget must not be negative";
+        return false;
+    }
+
+    // Read the tiles row by row
+    board = std::vector<std::vector<int>>(n, std::vector<int>(n, 0));
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            std::string name = "tile " + std::to_string(i * n + j + 1) + " of " + std::to_string(n * n);
+            if (!readField(in, name, board[i][j], error)) return false;
+            if (board[i][j] < 0) {
+                error = name + " must not be negative";
+                return false;
+            }
+        }
+    }
+
+    // Reject trailing garbage so a malformed request is not half-answered
+    std::string extra;
+    if (in >> extra) {
+        error = "too many values";
+        return false;
+    }
+
+    return true;
+}
+
+std::string GameServer::makeCacheKey(int n, int P, int solver, const std::vector<std::vector<int>>& board) {
+    // The budget is left out because Algorithm1 gives the same answer for any budget
+    std::string key = std::to_string(n) + " " + std::to_string(P) + " " + std::to_string(solver);
+    for (const auto& row : board) {
+        for (int value : row) {
+            key += " " + std::to_string(value);
+        }
+    }
+    return key;
+}
+
+char GameServer::solve(int n, int P, int solver, const std::vector<std::vector<int>>& board) {
+    // Only Algorithm1 exists so far; parseRequest has already rejected anything else
+    (void)solver;
+    Algorithm1 algorithm(n, P, board);
+    return algorithm.findBestMove();
+}
+
+void GameServer::serveClient(int clientFd) {
+    std::string pending;
+    char buffer[4096];
+
+    while (true) {
+        ssize_t received = read(clientFd, buffer, sizeof(buffer));
+        if (received < 0 && errno == EINTR) continue;
+        if (received <= 0) break;
+
+        pending.append(buffer, received);
+
+        // Answer every complete request in this chunk with a single write,
+        // so pipelined clients do not pay one round trip per request
+        std::string replies;
+        size_t start = 0;
+        size_t end;
+        while ((end = pending.find('\n', start)) != std::string::npos) {
+            std::string line = pending.substr(start, end - start);
+            if (!line.empty() && line.back() == '\r') line.pop_back();
+            if (!line.empty()) {
+                replies += handleRequest(line) + "\n";
+            }
+            start = end + 1;
+        }
+        pending.erase(0, start);
+
+        // Send the replies, retrying on short writes
+        size_t sent = 0;
+        while (sent < replies.size()) {
+            ssize_t written = send(clientFd, replies.data() + sent, replies.size() - sent, MSG_NOSIGNAL);
+            if (written < 0 && errno == EINTR) continue;
+            if (written <= 0) break; // Client went away
+            sent += written;
+        }
+        if (sent < replies.size()) break;
+
+        // A partial line this long can never be a valid request; refuse to keep buffering it
+        if (pending.size() > MAX_REQUEST_LENGTH) {
+            const std::string reply = "error request too long\n";
+            send(clientFd, reply.data(), reply.size(), MSG_NOSIGNAL);
+            break;
+        }
+    }
+
+    // Close under the lock so runSocket never shuts down a reused descriptor
+    std::lock_guard<std::mutex> lock(clientsMutex);
+    close(clientFd);
+    clientFds.erase(clientFd);
+    clientsDone.notify_all();
+}
+
+void GameServer::stopClients() {
+    std::unique_lock<std::mutex> lock(clientsMutex);
+
+    // Wake every client thread blocked in read so it finishes and exits
+    for (int clientFd : clientFds) {
+        shutdown(clientFd, SHUT_RDWR);
+    }
+    clientsDone.wait(lock, [this] { return clientFds.empty(); });
+}
+
+// Implementation of public methods
+GameServer::GameServer(size_t cacheLimit) : maxCacheEntries(cacheLimit) {
+}
+
+std::string GameServer::handleRequest(const std::string& line) {
+    int n, P, solver, budget;
+    std::vector<std::vector<int>> board;
+    std::string error;
+
+    if (!parseRequest(line, n, P, solver, budget, board, error)) {
+        return "error " + error;
+    }
+
+    std::string key = makeCacheKey(n, P, solver, board);
+
+    // Reuse an earlier answer for the same board if there is one
+    {
+        std::lock_guard<std::mutex> lock(cacheMutex);
+        auto found = moveCache.find(key);
+        if (found != moveCache.end()) {
+            return std::string(1, found->second);
+        }
+    }
+
+    char move = solve(n, P, solver, board);
+
+    {
+        std::lock_guard<std::mutex> lock(cacheMutex);
+        // Start over once the cache is full rather than growing without bound
+        if (moveCache.size() >= maxCacheEntries) {
+            moveCache.clear();
+        }
+        moveCache[key] = move;
+    }
+
+    return std::string(1, move);
+}
+
+void GameServer::runStdin() {
+    // Let cin buffer its input so in_avail() can see requests already waiting,
+    // and stop it flushing cout before every read
+    std::ios::sync_with_stdio(false);
+    std::cin.tie(nullptr);
+
+    std::string line;
+    while (std::getline(std::cin, line)) {
+        if (!line.empty() && line.back() == '\r') line.pop_back();
+        if (line.empty()) continue;
+
+        std::cout << handleRequest(line) << "\n";
+
+        // Only flush once the requests already waiting have been answered
+        if (std::cin.rdbuf()->in_avail() <= 0) {
+            std::cout.flush();
+        }
+    }
+    std::cout.flush();
+}
+
+bool GameServer::runSocket(const std::string& socketPath) {
+    sockaddr_un address;
+    std::memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+
+    if (socketPath.size() >= sizeof(address.sun_path)) {
+        std::cerr << "Socket path is too long: " << socketPath << "\n";
+        return false;
+    }
+    std::strncpy(address.sun_path, socketPath.c_str(), sizeof(address.sun_path) - 1);
+
+    // Remove a socket left behind by an earlier run, but only if nothing is
+    // listening on it any more; regular files and live sockets are left alone
+    struct stat existing;
+    if (lstat(socketPath.c_str(), &existing) == 0) {
+        if (!S_ISSOCK(existing.st_mode)) {
+            std::cerr << "Path exists and is not a socket: " << socketPath << "\n";
+            return false;
+        }
+
+        int probeFd = socket(AF_UNIX, SOCK_STREAM, 0);
+        if (probeFd < 0) {
+            std::cerr << "Could not create socket: " << std::strerror(errno) << "\n";
+            return false;
+        }
+        int probeResult = connect(probeFd, reinterpret_cast<sockaddr*>(&address), sizeof(address));
+        int probeError = errno;
+        close(probeFd);
+
+        if (probeResult == 0) {
+            std::cerr << "Socket is already in use by another server: " << socketPath << "\n";
+            return false;
+        }
+        if (probeError != ECONNREFUSED) {
+            std::cerr << "Could not check existing socket " << socketPath << ": "
+                      << std::strerror(probeError) << "\n";
+            return false;
+        }
+        unlink(socketPath.c_str());
+    }
+
+    int listenFd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (listenFd < 0) {
+        std::cerr << "Could not create socket: " << std::strerror(errno) << "\n";
+        return false;
+    }
+
+    if (bind(listenFd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) < 0 ||
+        listen(listenFd, SOMAXCONN) < 0) {
+        std::cerr << "Could not listen on " << socketPath << ": " << std::strerror(errno) << "\n";
+        close(listenFd);
+        return false;
+    }
+
+    // Remember which file this process bound, so shutdown only removes its own socket
+    struct stat bound;
+    bool haveBound = lstat(socketPath.c_str(), &bound) == 0;
+
+    // Stop on SIGINT or SIGTERM
+    struct sigaction stopAction;
+    struct sigaction oldIntAction;
+    struct sigaction oldTermAction;
+    std::memset(&stopAction, 0, sizeof(stopAction));
+    stopAction.sa_handler = requestStop;
+    sigemptyset(&stopAction.sa_mask);
+    stopRequested = 0;
+    sigaction(SIGINT, &stopAction, &oldIntAction);
+    sigaction(SIGTERM, &stopAction, &oldTermAction);
+
+    // Keep the stop signals blocked except while waiting in ppoll, so one that
+    // arrives between checking stopRequested and waiting is not lost.
+    // Client threads inherit this mask, so the signals always reach this thread
+    sigset_t stopSignals;
+    sigemptyset(&stopSignals);
+    sigaddset(&stopSignals, SIGINT);
+    sigaddset(&stopSignals, SIGTERM);
+    sigset_t oldMask;
+    pthread_sigmask(SIG_BLOCK, &stopSignals, &oldMask);
+    sigset_t waitMask = oldMask;
+    sigdelset(&waitMask, SIGINT);
+    sigdelset(&waitMask, SIGTERM);
+
+    // Only accept once ppoll says a client is waiting; non-blocking so a client
+    // that gives up in between cannot leave accept stuck
+    fcntl(listenFd, F_SETFL, fcntl(listenFd, F_GETFL) | O_NONBLOCK);
+
+    std::cerr << "Reverse 2048 server listening on " << socketPath << "\n";
+
+    bool cleanShutdown = true;
+
+    // Each client gets its own thread; all of them share this server's cache
+    while (!stopRequested) {
+        pollfd listenPoll;
+        listenPoll.fd = listenFd;
+        listenPoll.events = POLLIN;
+        listenPoll.revents = 0;
+        if (ppoll(&listenPoll, 1, nullptr, &waitMask) < 0) {
+            if (errno == EINTR) continue;
+            std::cerr << "Waiting for clients failed: " << std::strerror(errno) << "\n";
+            cleanShutdown = false;
+            break;
+        }
+
+        int clientFd = accept(listenFd, nullptr, nullptr);
+        if (clientFd < 0) {
+            if (errno == EINTR || errno == EAGAIN || errno == EWOULDBLOCK) continue;
+
+            // Only a broken listening socket is fatal; everything else is retried
+            if (errno == EBADF || errno == EINVAL || errno == ENOTSOCK || errno == EOPNOTSUPP) {
+                std::cerr << "Accept failed: " << std::strerror(errno) << "\n";
+                cleanShutdown = false;
+                break;
+            }
+            std::cerr << "Accept failed, retrying: " << std::strerror(errno) << "\n";
+
+            // Out of descriptors or memory: give clients a moment to disconnect
+            if (errno == EMFILE || errno == ENFILE || errno == ENOBUFS || errno == ENOMEM) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(100));
+            }
+            continue;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(clientsMutex);
+            clientFds.insert(clientFd);
+        }
+
+        // Some systems pass O_NONBLOCK on to accepted sockets; clients use blocking reads
+        fcntl(clientFd, F_SETFL, fcntl(clientFd, F_GETFL) & ~O_NONBLOCK);
+        std::thread(&GameServer::serveClient, this, clientFd).detach();
+    }
+
+    close(listenFd);
+
+    // Another server may have replaced the path since; leave its socket alone
+    struct stat current;
+    if (haveBound && lstat(socketPath.c_str(), &current) == 0 &&
+        current.st_dev == bound.st_dev && current.st_ino == bound.st_ino) {
+        unlink(socketPath.c_str());
+    }
+
+    // The client threads use this server, so they must finish before it goes away
+    stopClients();
+
+    pthread_sigmask(SIG_SETMASK, &oldMask, nullptr);
+    sigaction(SIGINT, &oldIntAction, nullptr);
+    sigaction(SIGTERM, &oldTermAction, nullptr);
+
+    if (cleanShutdown) {
+        std::cerr << "Reverse 2048 server stopped\n";
+    }
+    return cleanShutdown;
+}
@@ -0,0 +1,64 @@
+#ifndef SERVER_H
+#define SERVER_H
+
+#include <vector>
+#include <string>
+#include <sstream>
+#include <unordered_map>
+#include <mutex>
+#include <condition_variable>
+#include <set>
+
+// Long-lived request/response mode for driving the solvers from another program.
+//
+// Each request is one line:
+//     <n> <P> <solver> <budget> <n*n tile values, row by row>
+// and each response is one line holding the chosen move (w, a, s or d),
+// q when no move is possible, or "error <reason>" for a bad request.
+class GameServer {
+private:
+    // Best moves already computed, shared by every client
+    std::unordered_map<std::string, char> moveCache;
+    std::mutex cacheMutex;
+    size_t maxCacheEntries;
+
+    // Open client connections, so they can be stopped before the server is destroyed
+    std::set<int> clientFds;
+    std::mutex clientsMutex;
+    std::condition_variable clientsDone;
+
+    // Read one integer field; returns false and names the field in error if it is missing or invalid
+    bool readField(std::istringstream& in, const std::string& name, int& value, std::string& error);
+
+    // Parse a request line; returns false and fills error if it is invalid
+    bool parseRequest(const std::string& line, int& n, int& P, int& solver, int& budget,
+                      std::vector<std::vector<int>>& board, std::string& error);
+
+    // Build the cache key for a board state
+    std::string makeCacheKey(int n, int P, int solver, const std::vector<std::vector<int>>& board);
+
+    // Run the requested solver on a board
+    char solve(int n, int P, int solver, const std::vector<std::vector<int>>& board);
+
+    // Answer every request sent on one socket connection
+    void serveClient(int clientFd);
+
+    // Disconnect every client and wait for their threads to finish
+    void stopClients();
+
+public:
+    // Constructor
+    GameServer(size_t cacheLimit = 1000000);
+
+    // Answer a single request line (without the trailing newline)
+    std::string handleRequest(const std::string& line);
+
+    // Serve requests read from stdin until end of input
+    void runStdin();
+
+    // Serve requests on a Unix domain socket until SIGINT or SIGTERM.
+    // Returns true after a clean shutdown, false if the socket could not be used
+    bool runSocket(const std::string& socketPath);
+};
+
+#endif // SERVER_H
@@ -3,7 +3,9 @@
 #include <cstdlib> // For rand and srand
 #include <ctime>   // For time (seeding rand)
 #include <limits>  // For numeric_limits
+#include <string>
 #include "Algorithm1.h"
+#include "Server.h"
 
 using namespace std;
 
@@ -18,7 +20,17 @@ bool canMove(const vector<vector<int>>& board, int n);
 void displayGameOver(int moves);
 void displayWin(int moves);
 
-int main() {
+int main(int argc, char* argv[]) {
+    // Server mode: answer move requests from another program instead of showing the menu
+    if (argc > 1 && string(argv[1]) == "--server") {
+        GameServer server;
+        if (argc > 2) {
+            return server.runSocket(argv[2]) ? 0 : 1;
+        }
+        server.runStdin();
+        return 0;
+    }
+
     srand(time(0)); // Seed the random number generator
     int n; // Board size
     int P;